@@ -18,6 +18,8 @@
  */
 
 #include "mi-nvme-qemu.h"
+#include <linux/types.h>
+#include "../../mi-nvme-util-crc.h"
 #include <errno.h>
 #include <fcntl.h>
 #include <sys/ioctl.h>
@@ -66,7 +68,14 @@ int qemu_mi_write(uint8_t *data_out, uint16_t num_bytes)
     args.read_write = I2C_SMBUS_WRITE;
     args.size = I2C_SMBUS_BYTE;
     args.data = NULL;
+    __u8 addr = QEMU_SMBUS_ADDRESS_WRITE << 1;
     data_out[2] = (QEMU_SMBUS_ADDRESS_READ << 1) | 1;
+    /*
+     * The source address is only known here, so the PEC has to be redone:
+     * it covers the target write address and every byte sent before it.
+     */
+    data_out[num_bytes - 1] = Update_Crc8(Update_Crc8(0, &addr, 1),
+                                          data_out, num_bytes - 1);
     for (int i = 0; i < num_bytes; i++) {
         args.command = data_out[i];
         if (ioctl(i2cfwr, I2C_SMBUS, &args) < 0) {
@@ -34,9 +34,9 @@ static __u8 crc8(__u8 crc, __u8 crc_data)
     return data;
 }
 
-__u8 Calc_Crc8(__u8 *Buffer, __u8 byte_cnt)
+__u8 Update_Crc8(__u8 crc, __u8 *Buffer, __u16 byte_cnt)
 {
-    __u8 crc = 0, *p;
+    __u8 *p;
     int i;
     p = Buffer;
 
@@ -46,10 +46,16 @@ __u8 Calc_Crc8(__u8 *Buffer, __u8 byte_cnt)
     return crc;
 }
 
+__u8 Calc_Crc8(__u8 *Buffer, __u8 byte_cnt)
+{
+    return Update_Crc8(0, Buffer, byte_cnt);
+}
+
 uint32_t GenerateCRC(uint8_t *message, uint32_t length)
 {
     if (message != NULL) {
-        uint32_t crc = Calc_Crc32(0x1EDC6F41, -1, message, length);
+        /* CRC-32C, reflected form of 0x1EDC6F41 */
+        uint32_t crc = Calc_Crc32(0x82F63B78, -1, message, length);
         printf("Generated CRC32 : %"PRIx32"\n", crc);
         return crc;
     }
@@ -62,12 +68,12 @@ void gen_crc_table(uint32_t poly)
   register uint32_t crc_accum = 0;
 
   for (i = 0;  i < 256;  i++) {
-    crc_accum = ((uint32_t)i << 24);
+    crc_accum = i;
     for (j = 0;  j < 8;  j++) {
-        if (crc_accum & 0x80000000L) {
-            crc_accum = (crc_accum << 1) ^ poly;
+        if (crc_accum & 1) {
+            crc_accum = (crc_accum >> 1) ^ poly;
         } else {
-            crc_accum = (crc_accum << 1);
+            crc_accum = (crc_accum >> 1);
         }
     }
     crc_table[i] = crc_accum;
@@ -81,8 +87,8 @@ uint32_t Calc_Crc32(uint32_t poly, uint32_t crc_accum,
     gen_crc_table(poly);
 
     for (j = 0; j < data_blk_size; j++) {
-        i = ((int) (crc_accum >> 24) ^ *data_blk_ptr++) & 0xFF;
-        crc_accum = (crc_accum << 8) ^ crc_table[i];
+        i = (crc_accum ^ *data_blk_ptr++) & 0xFF;
+        crc_accum = (crc_accum >> 8) ^ crc_table[i];
     }
     crc_accum = ~crc_accum;
     return crc_accum;
@@ -28,6 +28,7 @@ uint32_t crc_table[256];
 uint32_t GenerateCRC(uint8_t *message, uint32_t length);
 void gen_crc_table();
 uint32_t Calc_Crc32(uint32_t poly, uint32_t crc_accum, uint8_t *message, uint32_t size);
+__u8 Update_Crc8(__u8 crc, __u8 *Buffer, __u16 byte_cnt);
 __u8 Calc_Crc8(__u8 *Buffer, __u8 byte_cnt);
 
 #endif